@@ -15,17 +15,21 @@ int main() {
         return true; // Continue
     });
 
-    // 3. Middleware Example: Auth (Simple check)
-    app.use([](Request& req, Response& res) -> bool {
-        if (req.path == "/secret") {
-            if (req.get_header("Authorization") != "secret_token") {
-                res.status_code = 401;
-                res.body = "Unauthorized";
-                return false; // Stop processing
-            }
-        }
+    // 3. Scoped Middleware Example: only runs for routes under /api
+    app.use("/api", [](Request& req, Response& res) -> bool {
+        res.set_header("X-API-Version", NEFIA_VERSION);
         return true;
     });
+
+    // Auth check, attached per-route below
+    auto require_auth = [](Request& req, Response& res) -> bool {
+        if (req.get_header("Authorization") != "secret_token") {
+            res.status_code = 401;
+            res.body = "Unauthorized";
+            return false; // Stop processing
+        }
+        return true;
+    };
     
     // 4. Static Route
     app.get("/", [](const Request& req, Response& res) {
@@ -44,8 +48,8 @@ int main() {
         res.send("Post: " + pid + ", Comment: " + cid);
     });
     
-    // 6. Secret Route (Protected by Middleware)
-    app.get("/secret", [](const Request& req, Response& res) {
+    // 6. Secret Route (Protected by Route-level Middleware)
+    app.get("/secret", require_auth, [](const Request& req, Response& res) {
         res.send("Welcome to the secret area!");
     });
 
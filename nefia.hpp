@@ -14,6 +14,7 @@
 #include <condition_variable>
 #include <queue>
 #include <memory>
+#include <type_traits>
 
 // ---------------------------------------------------------
 // CROSS-PLATFORM SOCKET SETUP
@@ -176,6 +177,28 @@ struct Response {
 
 using Handler = std::function<void(const Request&, Response&)>;
 using Middleware = std::function<bool(Request&, Response&)>;
+using RouteHandler = std::function<void(Request&, Response&)>;
+
+// Composes middlewares and a final handler into a single callable at compile time.
+// Each middleware returns false to stop the chain; no std::function sits between layers.
+template<typename H>
+auto nefia_chain(H&& handler) {
+    static_assert(std::is_invocable_v<const std::decay_t<H>&, const Request&, Response&>,
+                  "Nefia: the last argument must be a handler callable as void(const Request&, Response&)");
+    return [handler = std::forward<H>(handler)](Request& req, Response& res) {
+        handler(req, res);
+    };
+}
+
+template<typename M, typename Next, typename... Rest>
+auto nefia_chain(M&& mw, Next&& next, Rest&&... rest) {
+    static_assert(std::is_invocable_r_v<bool, const std::decay_t<M>&, Request&, Response&>,
+                  "Nefia: every argument before the handler must be a middleware callable as bool(Request&, Response&)");
+    return [mw = std::forward<M>(mw),
+            tail = nefia_chain(std::forward<Next>(next), std::forward<Rest>(rest)...)](Request& req, Response& res) {
+        if (mw(req, res)) tail(req, res);
+    };
+}
 
 class ThreadPool {
 public:
@@ -228,19 +251,32 @@ private:
     bool stop;
 };
 
-struct DynamicRoute {
+struct ScopedMiddleware {
+    std::string prefix;
+    Middleware middleware;
+};
+
+struct CompiledMiddleware {
+    Middleware middleware;
+    // Route :param values the prefix requires, e.g. {"area", "admin"} for "/admin" on "/:area/panel"
+    std::vector<std::pair<std::string, std::string>> conditions;
+};
+
+struct Route {
     std::string method;
     std::string pattern;
-    Handler handler;
+    RouteHandler handler;                         // Route-level middlewares + handler
+    std::vector<CompiledMiddleware> scoped_chain; // Prefix middlewares, resolved by compile_routes()
 };
 
 class Nefia {
 private:
     int port;
     socket_t server_fd;
-    std::map<std::string, Handler> static_routes;
-    std::vector<DynamicRoute> dynamic_routes;
+    std::map<std::string, Route> static_routes;
+    std::vector<Route> dynamic_routes;
     std::vector<Middleware> middlewares;
+    std::vector<ScopedMiddleware> scoped_middlewares;
     NefiaConfig config;
     std::unique_ptr<ThreadPool> thread_pool;
 
@@ -394,6 +430,68 @@ private:
         return true;
     }
 
+    // Segment-wise: "/api" covers "/api" and "/api/..." but not "/apiary".
+    // A :param in the prefix matches any segment. A :param in the pattern under a
+    // literal prefix segment becomes a condition on that param's value.
+    bool match_prefix(const std::string& prefix, const std::string& pattern,
+                      std::vector<std::pair<std::string, std::string>>& conditions) {
+        std::vector<std::string> pre_parts = split(prefix, '/');
+        std::vector<std::string> pat_parts = split(pattern, '/');
+        if (pre_parts.size() > pat_parts.size()) return false;
+
+        for (size_t i = 0; i < pre_parts.size(); ++i) {
+            if (pre_parts[i].front() == ':') continue;
+            if (pat_parts[i].front() == ':') {
+                conditions.emplace_back(pat_parts[i].substr(1), pre_parts[i]);
+            } else if (pre_parts[i] != pat_parts[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void compile_route(Route& route) {
+        route.scoped_chain.clear();
+        for (const auto& sm : scoped_middlewares) {
+            CompiledMiddleware cm{sm.middleware, {}};
+            if (match_prefix(sm.prefix, route.pattern, cm.conditions)) {
+                route.scoped_chain.push_back(std::move(cm));
+            }
+        }
+    }
+
+    // Resolve each route's full middleware chain once, before serving requests
+    void compile_routes() {
+        for (auto& [key, route] : static_routes) compile_route(route);
+        for (auto& route : dynamic_routes) compile_route(route);
+    }
+
+    void dispatch(const Route& route, Request& req, Response& res) {
+        for (const auto& cm : route.scoped_chain) {
+            bool applies = true;
+            for (const auto& [param, literal] : cm.conditions) {
+                auto it = req.params.find(param);
+                if (it == req.params.end() || it->second != literal) {
+                    applies = false;
+                    break;
+                }
+            }
+            if (applies && !cm.middleware(req, res)) return;
+        }
+        route.handler(req, res);
+    }
+
+    void add_route(const std::string& method, std::string path, RouteHandler handler) {
+        bool is_dynamic = path.find(':') != std::string::npos;
+        std::string route_key = method + ":" + path;
+        Route route{method, std::move(path), std::move(handler), {}};
+        if (is_dynamic) {
+            dynamic_routes.push_back(std::move(route));
+        } else {
+            static_routes[route_key] = std::move(route);
+        }
+    }
+
     void handle_client(socket_t client_socket) {
         // Set Receive Timeout (e.g., 5 seconds) to prevent blocking indefinitely
         #ifdef _WIN32
@@ -437,8 +535,9 @@ private:
                 bool route_found = false;
 
                 // 1. Check Static Routes
-                if (static_routes.find(route_key) != static_routes.end()) {
-                    static_routes[route_key](req, res);
+                auto it = static_routes.find(route_key);
+                if (it != static_routes.end()) {
+                    dispatch(it->second, req, res);
                     route_found = true;
                 } 
                 // 2. Check Dynamic Routes
@@ -448,7 +547,7 @@ private:
                             std::map<std::string, std::string> params;
                             if (match_dynamic_route(dr.pattern, req.path, params)) {
                                 req.params = params;
-                                dr.handler(req, res);
+                                dispatch(dr, req, res);
                                 route_found = true;
                                 break;
                             }
@@ -521,27 +620,32 @@ public:
         #endif
     }
 
+    // Global middleware: runs on every request, before routing
     void use(Middleware mw) {
         middlewares.push_back(mw);
     }
 
-    void get(std::string path, Handler handler) { 
-        if (path.find(':') != std::string::npos) {
-            dynamic_routes.push_back({"GET", path, handler});
-        } else {
-            static_routes["GET:" + path] = handler; 
-        }
+    // Scoped middleware: runs only for routes under the prefix, matched per segment.
+    // Prefix :params match any segment; route :params under a literal prefix segment
+    // become conditions on req.params (so "/admin" guards "/:area/panel" for /admin/panel).
+    void use(std::string prefix, Middleware mw) {
+        scoped_middlewares.push_back({std::move(prefix), std::move(mw)});
     }
 
-    void post(std::string path, Handler handler) { 
-        if (path.find(':') != std::string::npos) {
-            dynamic_routes.push_back({"POST", path, handler});
-        } else {
-            static_routes["POST:" + path] = handler; 
-        }
+    // get(path, handler) or get(path, mw1, mw2, ..., handler)
+    template<typename... Fns, typename = std::enable_if_t<(sizeof...(Fns) >= 1)>>
+    void get(std::string path, Fns&&... fns) {
+        add_route("GET", std::move(path), nefia_chain(std::forward<Fns>(fns)...));
+    }
+
+    template<typename... Fns, typename = std::enable_if_t<(sizeof...(Fns) >= 1)>>
+    void post(std::string path, Fns&&... fns) {
+        add_route("POST", std::move(path), nefia_chain(std::forward<Fns>(fns)...));
     }
 
     void listen() {
+        compile_routes();
+
         struct sockaddr_in address;
         int addrlen = sizeof(address);
 